@@ -0,0 +1,173 @@
+#include "aggregation.h"
+#include <algorithm>
+#include <iostream>
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+using namespace lbcrypto;
+
+namespace {
+
+size_t MaxThreads() {
+#ifdef _OPENMP
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief Balanced tree reduction over a small collection of ciphertexts.
+ * The first level combines input pairs out of place (the inputs are never modified);
+ * every later level accumulates the upper half of the working buffer into the lower
+ * half, so the buffer shrinks by half per level and its slots are reused.
+ * Callers keep the collection small (O(threads)), which bounds the temporaries.
+ * @param combine Returns op(a, b) as a new ciphertext.
+ * @param accumulate Replaces acc with op(acc, b) in place; b is an owned temporary it may modify.
+ */
+template <typename Combine, typename Accumulate>
+Ciphertext<DCRTPoly> TreeReduce(const std::vector<Ciphertext<DCRTPoly>>& ciphertexts, Combine combine,
+                                Accumulate accumulate) {
+    size_t n = ciphertexts.size();
+    if (n == 1) {
+        return ciphertexts[0]->Clone();
+    }
+
+    size_t pairs = n / 2;
+    std::vector<Ciphertext<DCRTPoly>> buffer((n + 1) / 2);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < pairs; ++i) {
+        buffer[i] = combine(ciphertexts[2 * i], ciphertexts[2 * i + 1]);
+    }
+    if (n % 2 == 1) {
+        buffer[pairs] = ciphertexts[n - 1]->Clone();
+    }
+
+    while (buffer.size() > 1) {
+        size_t count  = buffer.size();
+        size_t stride = (count + 1) / 2;
+
+#pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < count / 2; ++i) {
+            accumulate(buffer[i], buffer[i + stride]);
+        }
+        // Release the consumed upper half before the next level.
+        buffer.resize(stride);
+    }
+    return buffer[0];
+}
+
+}  // namespace
+
+Ciphertext<DCRTPoly> ParallelEvalAddMany(CryptoContext<DCRTPoly> context, const std::vector<Ciphertext<DCRTPoly>>& ciphertexts) {
+    size_t n = ciphertexts.size();
+    if (n == 0) {
+        std::cerr << "ERROR: Cannot aggregate an empty collection of ciphertexts!" << std::endl;
+        return nullptr;
+    }
+
+    // Addition depth does not matter, so each thread sums one contiguous chunk into a
+    // single accumulator in place; only the per-thread accumulators are tree-reduced.
+    size_t chunks = std::min(n, MaxThreads());
+    std::vector<Ciphertext<DCRTPoly>> partials(chunks);
+
+#pragma omp parallel for schedule(static)
+    for (size_t c = 0; c < chunks; ++c) {
+        size_t begin = c * n / chunks;
+        size_t end   = (c + 1) * n / chunks;
+
+        Ciphertext<DCRTPoly> acc = (end - begin >= 2) ? context->EvalAdd(ciphertexts[begin], ciphertexts[begin + 1])
+                                                      : ciphertexts[begin]->Clone();
+        for (size_t j = begin + 2; j < end; ++j) {
+            context->EvalAddInPlace(acc, ciphertexts[j]);
+        }
+        partials[c] = acc;
+    }
+
+    // The partials are owned here, so even the first tree level can accumulate in place.
+    while (partials.size() > 1) {
+        size_t count  = partials.size();
+        size_t stride = (count + 1) / 2;
+
+#pragma omp parallel for schedule(dynamic)
+        for (size_t i = 0; i < count / 2; ++i) {
+            context->EvalAddInPlace(partials[i], partials[i + stride]);
+        }
+        partials.resize(stride);
+    }
+    return partials[0];
+}
+
+Ciphertext<DCRTPoly> ParallelEvalMultMany(CryptoContext<DCRTPoly> context, const std::vector<Ciphertext<DCRTPoly>>& ciphertexts) {
+    size_t n = ciphertexts.size();
+    if (n == 0) {
+        std::cerr << "ERROR: Cannot aggregate an empty collection of ciphertexts!" << std::endl;
+        return nullptr;
+    }
+
+    // Only the inputs need the out-of-place EvalMult. Every later product has two owned
+    // temporaries as operands, so EvalMultMutableInPlace may rescale both and reuse acc.
+    auto combine    = [&context](const Ciphertext<DCRTPoly>& a, const Ciphertext<DCRTPoly>& b) {
+        return context->EvalMult(a, b);
+    };
+    auto accumulate = [&context](Ciphertext<DCRTPoly>& acc, Ciphertext<DCRTPoly>& b) {
+        context->EvalMultMutableInPlace(acc, b);
+    };
+
+    // Fixed-size blocks (a power of two, two inputs per thread) are tree-reduced in parallel.
+    // Block products are merged like a binary counter: two products of equal height are
+    // multiplied as soon as both exist. At most blockSize / 2 + log2(n) temporaries are alive,
+    // and the final depth is still ceil(log2(n)).
+    size_t blockSize = 2;
+    while (blockSize < 2 * MaxThreads()) {
+        blockSize <<= 1;
+    }
+
+    struct Node {
+        Ciphertext<DCRTPoly> ciphertext;
+        uint32_t height;
+    };
+    std::vector<Node> stack;
+
+    size_t pos = 0;
+    while (pos < n) {
+        // Full blocks first; the tail is split into strictly decreasing powers of two.
+        size_t size     = blockSize;
+        uint32_t height = 0;
+        while (size > n - pos) {
+            size >>= 1;
+        }
+        for (size_t s = size; s > 1; s >>= 1) {
+            ++height;
+        }
+
+        std::vector<Ciphertext<DCRTPoly>> block(ciphertexts.begin() + pos, ciphertexts.begin() + pos + size);
+        Ciphertext<DCRTPoly> product = TreeReduce(block, combine, accumulate);
+        pos += size;
+
+        while (!stack.empty() && stack.back().height == height) {
+            context->EvalMultMutableInPlace(product, stack.back().ciphertext);
+            stack.pop_back();
+            ++height;
+        }
+        stack.push_back(Node{product, height});
+    }
+
+    // Heights decrease strictly towards the top; combining smallest first gives depth ceil(log2(n)).
+    Ciphertext<DCRTPoly> result = stack.back().ciphertext;
+    for (size_t i = stack.size() - 1; i-- > 0;) {
+        context->EvalMultMutableInPlace(result, stack[i].ciphertext);
+    }
+    return result;
+}
+
+Ciphertext<DCRTPoly> EvalSumCollection(CryptoContext<DCRTPoly> context,
+                                       const std::vector<Ciphertext<DCRTPoly>>& ciphertexts, uint32_t batchSize) {
+    Ciphertext<DCRTPoly> total = ParallelEvalAddMany(context, ciphertexts);
+    if (total == nullptr) {
+        return nullptr;
+    }
+    return context->EvalSum(total, batchSize);
+}
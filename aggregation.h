@@ -0,0 +1,43 @@
+#ifndef AGGREGATION_H
+#define AGGREGATION_H
+
+#include "openfhe.h"
+#include <vector>
+
+using namespace lbcrypto;
+
+/**
+ * @brief Sums a collection of ciphertexts in parallel.
+ * Unlike CryptoContextImpl::EvalAddMany, which adds pairwise in a serial tree and keeps
+ * a full level of intermediate sums, the work is split across OpenMP threads.
+ * Each thread accumulates a contiguous chunk in place, then the per-thread sums are
+ * tree-reduced, so only O(threads) temporaries exist. The inputs are not modified.
+ * @param context The CryptoContext the ciphertexts belong to.
+ * @param ciphertexts The ciphertexts to add (at least one).
+ * @return The slot-wise sum, or nullptr if the collection is empty.
+ */
+Ciphertext<DCRTPoly> ParallelEvalAddMany(CryptoContext<DCRTPoly> context, const std::vector<Ciphertext<DCRTPoly>>& ciphertexts);
+
+/**
+ * @brief Multiplies a collection of ciphertexts with a balanced, parallel tree reduction.
+ * CryptoContextImpl::EvalMultMany has the same depth, but it runs serially and keeps
+ * every intermediate product of the tree alive until it returns.
+ * The tree is processed in fixed-size blocks, so O(threads + log2(n)) temporaries exist.
+ * The multiplicative depth consumed is ceil(log2(n)) instead of n - 1 for a serial loop.
+ * @param context The CryptoContext the ciphertexts belong to (EvalMult keys must be loaded).
+ * @param ciphertexts The ciphertexts to multiply (at least one).
+ * @return The slot-wise product, or nullptr if the collection is empty.
+ */
+Ciphertext<DCRTPoly> ParallelEvalMultMany(CryptoContext<DCRTPoly> context, const std::vector<Ciphertext<DCRTPoly>>& ciphertexts);
+
+/**
+ * @brief Sums every slot of every ciphertext in a collection.
+ * @param context The CryptoContext the ciphertexts belong to (EvalSum keys must be loaded).
+ * @param ciphertexts The ciphertexts to add (at least one).
+ * @param batchSize The number of occupied slots per ciphertext (a power of two).
+ * @return A ciphertext holding the grand total in slot 0, or nullptr if the collection is empty.
+ */
+Ciphertext<DCRTPoly> EvalSumCollection(CryptoContext<DCRTPoly> context,
+                                       const std::vector<Ciphertext<DCRTPoly>>& ciphertexts, uint32_t batchSize);
+
+#endif // AGGREGATION_H
@@ -0,0 +1,268 @@
+#include "column_store.h"
+#include "ciphertext-ser.h"
+#include "cryptocontext-ser.h"
+#include "scheme/bgvrns/bgvrns-ser.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace lbcrypto;
+
+namespace {
+
+// Read-only streambuf over a mapped byte range, so Serial::Deserialize can
+// consume a ciphertext straight from the mapping without copying it first.
+class MappedStreamBuf : public std::streambuf {
+public:
+    MappedStreamBuf(const char* data, size_t size) {
+        char* p = const_cast<char*>(data);
+        setg(p, p, p + size);
+    }
+};
+
+}  // namespace
+
+// ---------------------------------------------------------------------------------
+// ShardWriter
+// ---------------------------------------------------------------------------------
+
+ShardWriter::~ShardWriter() {
+    if (m_ofs.is_open()) {
+        Close();
+    }
+}
+
+bool ShardWriter::Open(const std::string& path) {
+    m_index.clear();
+    m_ofs.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_ofs.is_open()) {
+        std::cerr << "Error opening shard " << path << " for writing!" << std::endl;
+        return false;
+    }
+
+    ShardHeader header{SHARD_MAGIC, SHARD_VERSION, SHARD_BYTE_ORDER, 0};
+    m_ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return m_ofs.good();
+}
+
+bool ShardWriter::Append(const Ciphertext<DCRTPoly>& ciphertext, uint64_t firstRow, uint32_t rowCount) {
+    if (!m_ofs.is_open()) {
+        std::cerr << "Error: shard is not open for writing!" << std::endl;
+        return false;
+    }
+    if (ciphertext == nullptr) {
+        std::cerr << "Error: cannot append a null ciphertext to a shard!" << std::endl;
+        return false;
+    }
+    // rowCount is the slot occupancy recorded in the index, so it must fit the ciphertext's slots.
+    uint32_t slots = ciphertext->GetCryptoContext()->GetRingDimension();
+    if (rowCount == 0 || rowCount > slots || rowCount > UINT64_MAX - firstRow) {
+        std::cerr << "Error: shard row count " << rowCount << " must be between 1 and " << slots << "!" << std::endl;
+        return false;
+    }
+    if (!m_index.empty()) {
+        const ShardIndexEntry& last = m_index.back();
+        if (firstRow < last.firstRow + last.rowCount) {
+            std::cerr << "Error: shard rows must be appended in ascending order!" << std::endl;
+            return false;
+        }
+    }
+
+    std::stringstream ss;
+    Serial::Serialize(ciphertext, ss, SerType::BINARY);
+    const std::string blob = ss.str();
+
+    ShardIndexEntry entry{};
+    entry.offset   = static_cast<uint64_t>(m_ofs.tellp());
+    entry.length   = blob.size();
+    entry.firstRow = firstRow;
+    entry.rowCount = rowCount;
+    entry.level    = static_cast<uint32_t>(ciphertext->GetLevel());
+    entry.towers   = static_cast<uint32_t>(ciphertext->GetElements()[0].GetNumOfElements());
+
+    m_ofs.write(blob.data(), blob.size());
+    if (!m_ofs.good()) {
+        std::cerr << "Error writing ciphertext to shard!" << std::endl;
+        return false;
+    }
+    m_index.push_back(entry);
+    return true;
+}
+
+bool ShardWriter::Close() {
+    if (!m_ofs.is_open()) {
+        return false;
+    }
+
+    ShardFooter footer{};
+    footer.indexOffset = static_cast<uint64_t>(m_ofs.tellp());
+    footer.entryCount  = m_index.size();
+    footer.magic       = SHARD_MAGIC;
+    footer.version     = SHARD_VERSION;
+
+    m_ofs.write(reinterpret_cast<const char*>(m_index.data()), m_index.size() * sizeof(ShardIndexEntry));
+    m_ofs.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    bool ok = m_ofs.good();
+    m_ofs.close();
+
+    if (!ok) {
+        std::cerr << "Error writing shard footer index!" << std::endl;
+    }
+    return ok;
+}
+
+// ---------------------------------------------------------------------------------
+// ShardReader
+// ---------------------------------------------------------------------------------
+
+ShardReader::~ShardReader() {
+    Close();
+}
+
+bool ShardReader::Open(const std::string& path) {
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error opening shard " << path << " for reading!" << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ShardHeader) + sizeof(ShardFooter)) {
+        std::cerr << "Error: shard " << path << " is truncated!" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* addr  = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        std::cerr << "Error mapping shard " << path << "!" << std::endl;
+        return false;
+    }
+    // Queries touch a few blobs scattered across the file; don't let the kernel read ahead.
+    ::madvise(addr, size, MADV_RANDOM);
+
+    m_data = static_cast<const char*>(addr);
+    m_size = size;
+
+    ShardHeader header;
+    ShardFooter footer;
+    std::memcpy(&header, m_data, sizeof(header));
+    std::memcpy(&footer, m_data + m_size - sizeof(footer), sizeof(footer));
+
+    if (header.byteOrder == 0x04030201) {
+        std::cerr << "Error: shard " << path << " was written on a host with a different byte order!" << std::endl;
+        Close();
+        return false;
+    }
+    if (header.magic != SHARD_MAGIC || footer.magic != SHARD_MAGIC || header.version != SHARD_VERSION ||
+        footer.version != SHARD_VERSION || header.byteOrder != SHARD_BYTE_ORDER) {
+        std::cerr << "Error: " << path << " is not a version " << SHARD_VERSION << " shard!" << std::endl;
+        Close();
+        return false;
+    }
+
+    uint64_t indexEnd = m_size - sizeof(footer);
+    if (footer.indexOffset > indexEnd || footer.entryCount > (indexEnd - footer.indexOffset) / sizeof(ShardIndexEntry)) {
+        std::cerr << "Error: shard " << path << " has a corrupt footer index!" << std::endl;
+        Close();
+        return false;
+    }
+
+    m_index.resize(footer.entryCount);
+    std::memcpy(m_index.data(), m_data + footer.indexOffset, footer.entryCount * sizeof(ShardIndexEntry));
+
+    for (size_t i = 0; i < m_index.size(); ++i) {
+        const ShardIndexEntry& entry = m_index[i];
+        // Compare lengths rather than offset + length, which a corrupt entry could overflow.
+        if (entry.offset < sizeof(ShardHeader) || entry.offset > footer.indexOffset ||
+            entry.length > footer.indexOffset - entry.offset) {
+            std::cerr << "Error: shard " << path << " has an out-of-range index entry!" << std::endl;
+            Close();
+            return false;
+        }
+        // LoadRows() binary-searches the index, so rows must be ascending and non-overlapping.
+        if (entry.rowCount > UINT64_MAX - entry.firstRow ||
+            (i > 0 && entry.firstRow < m_index[i - 1].firstRow + m_index[i - 1].rowCount)) {
+            std::cerr << "Error: shard " << path << " has an unordered index entry!" << std::endl;
+            Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShardReader::Close() {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_data        = nullptr;
+    m_size        = 0;
+    m_bytesLoaded = 0;
+    m_index.clear();
+}
+
+Ciphertext<DCRTPoly> ShardReader::Load(size_t i) const {
+    if (m_data == nullptr || i >= m_index.size()) {
+        std::cerr << "Error: shard ciphertext " << i << " is out of range!" << std::endl;
+        return nullptr;
+    }
+
+    const ShardIndexEntry& entry = m_index[i];
+    MappedStreamBuf buf(m_data + entry.offset, entry.length);
+    std::istream is(&buf);
+
+    Ciphertext<DCRTPoly> ciphertext;
+    try {
+        Serial::Deserialize(ciphertext, is, SerType::BINARY);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error deserializing shard ciphertext " << i << ": " << e.what() << std::endl;
+        return nullptr;
+    }
+    m_bytesLoaded += entry.length;
+    return ciphertext;
+}
+
+bool ShardReader::LoadRows(uint64_t firstRow, uint64_t lastRow, std::vector<Ciphertext<DCRTPoly>>& ciphertexts,
+                           std::vector<ShardIndexEntry>* entries) const {
+    ciphertexts.clear();
+    if (entries != nullptr) {
+        entries->clear();
+    }
+    if (firstRow > lastRow) {
+        return true;
+    }
+
+    // Entries are sorted by firstRow: skip straight to the first one that ends after firstRow.
+    auto it = std::upper_bound(m_index.begin(), m_index.end(), firstRow,
+                               [](uint64_t row, const ShardIndexEntry& e) { return row < e.firstRow + e.rowCount; });
+
+    for (; it != m_index.end() && it->firstRow <= lastRow; ++it) {
+        Ciphertext<DCRTPoly> ciphertext = Load(static_cast<size_t>(it - m_index.begin()));
+        if (ciphertext == nullptr) {
+            // A partial result would silently drop rows from any aggregate over it.
+            ciphertexts.clear();
+            if (entries != nullptr) {
+                entries->clear();
+            }
+            return false;
+        }
+        ciphertexts.push_back(ciphertext);
+        if (entries != nullptr) {
+            entries->push_back(*it);
+        }
+    }
+    return true;
+}
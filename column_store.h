@@ -0,0 +1,155 @@
+#ifndef COLUMN_STORE_H
+#define COLUMN_STORE_H
+
+#include "openfhe.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace lbcrypto;
+
+/*
+ * On-disk layout of one encrypted column shard (all integers in the writer's host byte order):
+ *
+ *   [ShardHeader]
+ *   [ciphertext 0][ciphertext 1] ... [ciphertext N-1]   (SerType::BINARY blobs)
+ *   [ShardIndexEntry 0] ... [ShardIndexEntry N-1]       (footer index)
+ *   [ShardFooter]
+ *
+ * The footer sits at a fixed offset from the end of the file, so a reader can
+ * find the index without scanning the ciphertext blobs. The header records a
+ * byte-order marker; a reader on a host with the other byte order rejects the shard.
+ */
+
+constexpr uint32_t SHARD_MAGIC      = 0x53434548;  // "HECS"
+constexpr uint32_t SHARD_VERSION    = 1;
+constexpr uint32_t SHARD_BYTE_ORDER = 0x01020304;
+
+struct ShardHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t byteOrder;  // SHARD_BYTE_ORDER as written by the host
+    uint32_t reserved;
+};
+
+/**
+ * @brief Footer index record describing one ciphertext in the shard.
+ * Each ciphertext packs rowCount consecutive rows into its first slots.
+ */
+struct ShardIndexEntry {
+    uint64_t offset;     // byte offset of the serialized ciphertext
+    uint64_t length;     // size of the serialized ciphertext in bytes
+    uint64_t firstRow;   // first row stored in this ciphertext
+    uint32_t rowCount;   // number of rows (= occupied slots)
+    uint32_t level;      // ciphertext level at write time
+    uint32_t towers;     // number of RNS towers at write time
+    uint32_t reserved;
+};
+
+struct ShardFooter {
+    uint64_t indexOffset;
+    uint64_t entryCount;
+    uint32_t magic;
+    uint32_t version;
+};
+
+static_assert(sizeof(ShardHeader) == 16, "ShardHeader must have a fixed layout");
+static_assert(sizeof(ShardIndexEntry) == 40, "ShardIndexEntry must have a fixed layout");
+static_assert(sizeof(ShardFooter) == 24, "ShardFooter must have a fixed layout");
+
+/**
+ * @brief Appends ciphertexts to a new shard file and writes the footer index on Close().
+ */
+class ShardWriter {
+public:
+    ShardWriter() = default;
+    ~ShardWriter();
+
+    /**
+     * @brief Creates (or truncates) the shard file and writes its header.
+     * @param path The shard file path.
+     * @return true on success.
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Serializes one ciphertext holding rows [firstRow, firstRow + rowCount).
+     * Rows must be appended in ascending, non-overlapping order, and rowCount must be
+     * between 1 and the ring dimension (the ciphertext's slot count).
+     * @return true on success.
+     */
+    bool Append(const Ciphertext<DCRTPoly>& ciphertext, uint64_t firstRow, uint32_t rowCount);
+
+    /**
+     * @brief Writes the footer index and closes the file.
+     * @return true on success.
+     */
+    bool Close();
+
+private:
+    std::ofstream m_ofs;
+    std::vector<ShardIndexEntry> m_index;
+};
+
+/**
+ * @brief Memory-maps a shard and deserializes only the ciphertexts a query touches.
+ * The CryptoContext the shard was written with must already be loaded in this process.
+ */
+class ShardReader {
+public:
+    ShardReader() = default;
+    ~ShardReader();
+
+    ShardReader(const ShardReader&)            = delete;
+    ShardReader& operator=(const ShardReader&) = delete;
+
+    /**
+     * @brief Maps the shard file and validates its header, footer and index.
+     * @param path The shard file path.
+     * @return true on success.
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Unmaps the shard. Called automatically by the destructor.
+     */
+    void Close();
+
+    /**
+     * @brief The footer index; valid only after a successful Open().
+     */
+    const std::vector<ShardIndexEntry>& Index() const {
+        return m_index;
+    }
+
+    /**
+     * @brief Deserializes the i-th ciphertext of the shard.
+     * @return The ciphertext, or nullptr on failure (including a corrupt blob).
+     */
+    Ciphertext<DCRTPoly> Load(size_t i) const;
+
+    /**
+     * @brief Deserializes every ciphertext overlapping rows [firstRow, lastRow].
+     * @param ciphertexts Receives the ciphertexts in row order (empty if none overlap).
+     * @param entries If not null, receives the index entries of the returned ciphertexts.
+     * @return false if any overlapping ciphertext fails to load; both outputs are then empty.
+     */
+    bool LoadRows(uint64_t firstRow, uint64_t lastRow, std::vector<Ciphertext<DCRTPoly>>& ciphertexts,
+                  std::vector<ShardIndexEntry>* entries = nullptr) const;
+
+    /**
+     * @brief Number of ciphertext bytes deserialized since the shard was opened (for I/O accounting).
+     */
+    uint64_t BytesLoaded() const {
+        return m_bytesLoaded;
+    }
+
+private:
+    const char* m_data = nullptr;
+    size_t m_size      = 0;
+    std::vector<ShardIndexEntry> m_index;
+    mutable uint64_t m_bytesLoaded = 0;
+};
+
+#endif // COLUMN_STORE_H
@@ -0,0 +1,94 @@
+#include "openfhe.h"
+#include "aggregation.h"
+#include "key_management.h"
+#include <chrono>
+#include <iostream>
+
+using namespace lbcrypto;
+
+/**
+ * @brief Sets up the core BGV-RNS CryptoContext parameters.
+ * @return The initialized CryptoContext.
+ */
+CryptoContext<DCRTPoly> SetupContext() {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetMultiplicativeDepth(3);
+    parameters.SetPlaintextModulus(536903681);
+    parameters.SetMaxRelinSkDeg(3);
+
+    CryptoContext<DCRTPoly> context = GenCryptoContext(parameters);
+    context->Enable(PKE);
+    context->Enable(KEYSWITCH);
+    context->Enable(LEVELEDSHE);
+    context->Enable(ADVANCEDSHE);  // Needed for EvalSum
+
+    std::cout << "Context setup complete (BGV-RNS, Depth 3).\n";
+    return context;
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const size_t numRecords  = 1024;
+    const size_t numFactors  = 8;  // log2(8) = 3 = the context depth
+    const uint32_t batchSize = 4;
+
+    CryptoContext<DCRTPoly> context = SetupContext();
+    KeyPair<DCRTPoly> keyPair       = GenerateKeys(context);
+    context->EvalSumKeyGen(keyPair.secretKey);
+
+    std::vector<Ciphertext<DCRTPoly>> records;
+    for (size_t i = 0; i < numRecords; ++i) {
+        std::vector<int64_t> record = {1, 2, 3, static_cast<int64_t>(i % 10)};
+        records.push_back(context->Encrypt(keyPair.publicKey, context->MakePackedPlaintext(record)));
+    }
+
+    // ---------------------------------------------------------------------------------
+    // STEP 1: SUM OVER ALL RECORDS
+    // ---------------------------------------------------------------------------------
+    std::cout << "\n--- 1. SUM OF " << numRecords << " RECORDS ---" << std::endl;
+
+    auto start  = std::chrono::steady_clock::now();
+    auto serial = records[0];
+    for (size_t i = 1; i < numRecords; ++i) {
+        serial = context->EvalAdd(serial, records[i]);
+    }
+    double serialMs = ElapsedMs(start);
+
+    start         = std::chrono::steady_clock::now();
+    auto treeSum  = ParallelEvalAddMany(context, records);
+    double treeMs = ElapsedMs(start);
+
+    Plaintext result;
+    context->Decrypt(keyPair.secretKey, treeSum, &result);
+    result->SetLength(batchSize);
+    std::cout << "Result: " << result << "  (serial " << serialMs << " ms, tree " << treeMs << " ms)\n";
+
+    // ---------------------------------------------------------------------------------
+    // STEP 2: PRODUCT OF RECORDS (DEPTH log2(n))
+    // ---------------------------------------------------------------------------------
+    std::cout << "\n--- 2. PRODUCT OF " << numFactors << " RECORDS ---" << std::endl;
+
+    std::vector<Ciphertext<DCRTPoly>> factors(records.begin() + 1, records.begin() + 1 + numFactors);
+    start            = std::chrono::steady_clock::now();
+    auto treeProduct = ParallelEvalMultMany(context, factors);
+    double productMs = ElapsedMs(start);
+
+    context->Decrypt(keyPair.secretKey, treeProduct, &result);
+    result->SetLength(batchSize);
+    std::cout << "Result: " << result << "  (tree " << productMs << " ms, a serial loop would need depth "
+              << numFactors - 1 << ")\n";
+
+    // ---------------------------------------------------------------------------------
+    // STEP 3: GRAND TOTAL OVER ALL SLOTS OF ALL RECORDS
+    // ---------------------------------------------------------------------------------
+    std::cout << "\n--- 3. GRAND TOTAL (EvalSumCollection) ---" << std::endl;
+
+    auto total = EvalSumCollection(context, records, batchSize);
+    context->Decrypt(keyPair.secretKey, total, &result);
+    result->SetLength(1);
+    std::cout << "Result: " << result << std::endl;
+    return 0;
+}
@@ -0,0 +1,21 @@
+#include "openfhe.h"
+#include "key_management.h"
+#include <iostream>
+
+using namespace lbcrypto;
+
+int main() {
+    // Compare digit counts: at a fixed ring dimension larger dnum costs more per key switch,
+    // but its smaller auxiliary modulus P can let the library choose a smaller ring dimension.
+    // BV avoids the auxiliary modulus entirely at the cost of many more digits.
+    // Each row shows the ring dimension and Q/P towers behind its key size and latency.
+    std::vector<KeySwitchConfig> configs = {
+        {HYBRID, 1, 0},
+        {HYBRID, 2, 0},
+        {HYBRID, 4, 0},
+        {BV, 0, 0},
+    };
+
+    ReportKeySwitchTradeoff(configs);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "openfhe.h"
+#include "key_management.h"
+#include "param_profile.h"
+#include <iostream>
+
+using namespace lbcrypto;
+
+/**
+ * @brief Sets up the core BGV-RNS CryptoContext parameters (runtime-parameter path).
+ * @return The initialized CryptoContext.
+ */
+CryptoContext<DCRTPoly> SetupContext() {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetMultiplicativeDepth(3);
+    parameters.SetPlaintextModulus(536903681);
+    parameters.SetMaxRelinSkDeg(3);
+
+    CryptoContext<DCRTPoly> context = GenCryptoContext(parameters);
+    context->Enable(PKE);
+    context->Enable(KEYSWITCH);
+    context->Enable(LEVELEDSHE);
+
+    std::cout << "Context setup complete (BGV-RNS, Depth 3).\n";
+    return context;
+}
+
+/**
+ * @brief Runs one EvalMult and prints the decrypted result.
+ */
+void CheckEvalMult(CryptoContext<DCRTPoly> context) {
+    KeyPair<DCRTPoly> keyPair = GenerateKeys(context);
+
+    std::vector<int64_t> vector1 = {5, 6, 7, 8};
+    std::vector<int64_t> vector2 = {2, 3, 4, 5};
+    auto ciphertext1 = context->Encrypt(keyPair.publicKey, context->MakePackedPlaintext(vector1));
+    auto ciphertext2 = context->Encrypt(keyPair.publicKey, context->MakePackedPlaintext(vector2));
+    auto ciphertextMult = context->EvalMult(ciphertext1, ciphertext2);
+
+    Plaintext result;
+    context->Decrypt(keyPair.secretKey, ciphertextMult, &result);
+    result->SetLength(vector1.size());
+    std::cout << "Result: " << result << " (expected 10, 18, 28, 40)" << std::endl;
+}
+
+int main() {
+    // ---------------------------------------------------------------------------------
+    // STEP 1: WHAT DOES THE RUNTIME PATH ACTUALLY PRODUCE?
+    // ---------------------------------------------------------------------------------
+    std::cout << "\n--- 1. RUNTIME PARAMETER PATH ---" << std::endl;
+    CryptoContext<DCRTPoly> generic = SetupContext();
+    uint32_t ringDim                = generic->GetRingDimension();
+    size_t towers                   = generic->GetCryptoParameters()->GetElementParams()->GetParams().size();
+    std::cout << "Ring dimension " << ringDim << ", " << towers << " towers\n";
+    std::cout << "To pin them, build with -DHE_PROFILE_RING_DIM=" << ringDim << " -DHE_PROFILE_TOWERS=" << towers
+              << "\n";
+
+    if (!MatchesProfile(generic)) {
+        std::cerr << "ERROR: SetupContext() no longer matches the pinned ParamProfile (ring dimension "
+                  << ParamProfile::ringDim << ", " << ParamProfile::towers << " towers)!" << std::endl;
+        return 1;
+    }
+
+    // ---------------------------------------------------------------------------------
+    // STEP 2: CONTEXT BUILT FROM THE PROFILE
+    // ---------------------------------------------------------------------------------
+    std::cout << "\n--- 2. PARAMETER PROFILE PATH ---" << std::endl;
+    CryptoContext<DCRTPoly> profileContext = SetupProfileContext();
+    if (profileContext == nullptr) {
+        return 1;
+    }
+    CheckEvalMult(profileContext);
+
+    std::cout << "\nSuccess: the runtime path and the profile agree on the production parameters.\n";
+    return 0;
+}
@@ -3,14 +3,48 @@
 #include "cryptocontext-ser.h"
 #include "key/key-ser.h"
 #include "scheme/bgvrns/bgvrns-ser.h"
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 using namespace lbcrypto;
 
+CryptoContext<DCRTPoly> SetupContext(const KeySwitchConfig& config) {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetMultiplicativeDepth(3);
+    parameters.SetPlaintextModulus(536903681);
+    parameters.SetMaxRelinSkDeg(3);
+    parameters.SetKeySwitchTechnique(config.technique);
+    if (config.technique == HYBRID && config.numLargeDigits != 0) {
+        parameters.SetNumLargeDigits(config.numLargeDigits);
+    }
+    if (config.technique == BV && config.digitSize != 0) {
+        parameters.SetDigitSize(config.digitSize);
+    }
+
+    CryptoContext<DCRTPoly> context = GenCryptoContext(parameters);
+    context->Enable(PKE);
+    context->Enable(KEYSWITCH);
+    context->Enable(LEVELEDSHE);
+
+    std::cout << "Context setup complete (BGV-RNS, Depth 3).\n";
+    return context;
+}
+
 KeyPair<DCRTPoly> GenerateKeys(CryptoContext<DCRTPoly> context) {
     std::cout << "\n--- 1. OFFLINE KEY GENERATION ---" << std::endl;
     std::cout << "Generating KeyPair and Evaluation Keys..." << std::endl;
+
+    // Report the decomposition the relinearization keys will use
+    auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(context->GetCryptoParameters());
+    if (cryptoParams != nullptr) {
+        if (cryptoParams->GetKeySwitchTechnique() == HYBRID) {
+            std::cout << "Key switching: HYBRID, dnum = " << cryptoParams->GetNumPartQ() << std::endl;
+        } else {
+            std::cout << "Key switching: BV, digit size = " << cryptoParams->GetDigitSize() << std::endl;
+        }
+    }
     
     // Generate KeyPair and Evaluation Keys
     KeyPair<DCRTPoly> keyPair = context->KeyGen();
@@ -50,3 +84,62 @@ void SerializeKeys(CryptoContext<DCRTPoly> context, const KeyPair<DCRTPoly>& key
 
     std::cout << "Keys successfully saved: secret_key.json, public_key.json, mult_key.json\n";
 }
+
+size_t EvalMultKeySize(CryptoContext<DCRTPoly> context, const std::string& keyTag) {
+    std::stringstream ss;
+    if (context->SerializeEvalMultKey(ss, SerType::BINARY, keyTag) == false) {
+        std::cerr << "Error serializing multiplication keys!" << std::endl;
+        return 0;
+    }
+    return ss.str().size();
+}
+
+void ReportKeySwitchTradeoff(const std::vector<KeySwitchConfig>& configs) {
+    const int iterations = 20;
+
+    std::vector<std::string> rows;
+    for (const auto& config : configs) {
+        CryptoContext<DCRTPoly> context = SetupContext(config);
+        KeyPair<DCRTPoly> keyPair       = GenerateKeys(context);
+        size_t keyBytes                 = EvalMultKeySize(context, keyPair.secretKey->GetKeyTag());
+
+        std::vector<int64_t> vector1 = {5, 6, 7, 8};
+        std::vector<int64_t> vector2 = {2, 3, 4, 5};
+        auto ciphertext1 = context->Encrypt(keyPair.publicKey, context->MakePackedPlaintext(vector1));
+        auto ciphertext2 = context->Encrypt(keyPair.publicKey, context->MakePackedPlaintext(vector2));
+
+        // Warm-up run so one-time precomputations are not timed
+        auto ciphertextMult = context->EvalMult(ciphertext1, ciphertext2);
+        auto start          = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            ciphertextMult = context->EvalMult(ciphertext1, ciphertext2);
+        }
+        double latencyUs =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+        std::ostringstream row;
+        if (config.technique == HYBRID) {
+            row << "HYBRID dnum=";
+            row << (config.numLargeDigits == 0 ? std::string("default") : std::to_string(config.numLargeDigits));
+        } else {
+            row << "BV digitSize=";
+            row << (config.digitSize == 0 ? std::string("default") : std::to_string(config.digitSize));
+        }
+        auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(context->GetCryptoParameters());
+        size_t towersQ    = context->GetCryptoParameters()->GetElementParams()->GetParams().size();
+        size_t towersP    = (config.technique == HYBRID && cryptoParams != nullptr)
+                                ? cryptoParams->GetParamsP()->GetParams().size()
+                                : 0;
+        row << " | N " << context->GetRingDimension() << " | Q towers " << towersQ << " | P towers " << towersP;
+        row << " | mult key " << keyBytes / 1024 << " KiB | EvalMult " << latencyUs << " us";
+        rows.push_back(row.str());
+
+        // ClearEvalMultKeys() is static; drop only this config's key so other contexts keep theirs.
+        context->ClearEvalMultKeys(keyPair.secretKey->GetKeyTag());
+    }
+
+    std::cout << "\n--- KEY SWITCHING TRADEOFF (mult key size / EvalMult latency) ---" << std::endl;
+    for (const auto& row : rows) {
+        std::cout << row << std::endl;
+    }
+}
@@ -5,6 +5,27 @@
 
 using namespace lbcrypto;
 
+/**
+ * @brief Key-switching configuration for the relinearization keys.
+ * HYBRID uses an auxiliary modulus P and splits Q into numLargeDigits digits (dnum).
+ * At a fixed ring dimension, fewer digits give smaller keys and cheaper key switching
+ * (fewer digits to ModUp, shorter key inner product) but need a larger P. More digits
+ * only pay off when the smaller P lets the library pick a smaller ring dimension.
+ * BV uses no auxiliary modulus and decomposes with digits of digitSize bits instead.
+ */
+struct KeySwitchConfig {
+    KeySwitchTechnique technique = HYBRID;
+    uint32_t numLargeDigits      = 0;  // HYBRID only; 0 lets the library choose
+    uint32_t digitSize           = 0;  // BV only; 0 lets the library choose
+};
+
+/**
+ * @brief Sets up the core BGV-RNS CryptoContext with a chosen key-switching configuration.
+ * @param config The key-switching technique and decomposition.
+ * @return The initialized CryptoContext.
+ */
+CryptoContext<DCRTPoly> SetupContext(const KeySwitchConfig& config);
+
 /**
  * @brief Generates the Public, Secret, and Evaluation Keys.
  * @param context The configured CryptoContext.
@@ -19,4 +40,19 @@ KeyPair<DCRTPoly> GenerateKeys(CryptoContext<DCRTPoly> context);
  */
 void SerializeKeys(CryptoContext<DCRTPoly> context, const KeyPair<DCRTPoly>& keyPair);
 
+/**
+ * @brief Returns the size in bytes of the serialized (BINARY) multiplication keys for one secret key.
+ * @param context The CryptoContext holding the EvalMult keys.
+ * @param keyTag The tag of the secret key the EvalMult keys were generated for.
+ */
+size_t EvalMultKeySize(CryptoContext<DCRTPoly> context, const std::string& keyTag);
+
+/**
+ * @brief Prints the ring dimension, Q/P tower counts, relinearization key size and EvalMult
+ * latency of each configuration, so memory-constrained and latency-critical nodes can pick
+ * one from the same code.
+ * @param configs The key-switching configurations to compare.
+ */
+void ReportKeySwitchTradeoff(const std::vector<KeySwitchConfig>& configs);
+
 #endif // KEY_MANAGEMENT_H
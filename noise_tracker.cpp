@@ -0,0 +1,200 @@
+#include "noise_tracker.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace lbcrypto;
+
+namespace {
+
+// Discrete Gaussian parameter used by OpenFHE for encryption noise.
+constexpr double NOISE_SIGMA = 3.19;
+
+// Headroom kept below Q/2 when placing mod-reductions, since the noise model is heuristic.
+constexpr double NOISE_SAFETY_BITS = 10.0;
+
+// log2(2^a + 2^b) without leaving the log domain.
+double LogAdd(double a, double b) {
+    double hi = std::max(a, b);
+    double lo = std::min(a, b);
+    return hi + std::log2(1.0 + std::exp2(lo - hi));
+}
+
+}  // namespace
+
+double MeasureNoiseBits(const PrivateKey<DCRTPoly>& secretKey, const Ciphertext<DCRTPoly>& ciphertext) {
+    const std::vector<DCRTPoly>& elements = ciphertext->GetElements();
+    size_t towers                         = elements[0].GetNumOfElements();
+
+    DCRTPoly s = secretKey->GetPrivateElement();
+    if (s.GetNumOfElements() > towers) {
+        s.DropLastElements(s.GetNumOfElements() - towers);
+    }
+
+    // b = c0 + c1*s + c2*s^2 + ... (all in EVALUATION format)
+    DCRTPoly b    = elements[0];
+    DCRTPoly sPow = s;
+    for (size_t i = 1; i < elements.size(); ++i) {
+        b += elements[i] * sPow;
+        if (i + 1 < elements.size()) {
+            sPow *= s;
+        }
+    }
+    b.SetFormat(Format::COEFFICIENT);
+
+    // Lift to Z_Q and take the largest coefficient in (-Q/2, Q/2].
+    Poly lifted               = b.CRTInterpolate();
+    const BigInteger& modulus = lifted.GetModulus();
+    BigInteger half           = modulus >> 1;
+    BigInteger maxCoeff(0);
+    for (usint j = 0; j < lifted.GetLength(); ++j) {
+        BigInteger c = lifted[j];
+        if (c > half) {
+            c = modulus - c;
+        }
+        if (c > maxCoeff) {
+            maxCoeff = c;
+        }
+    }
+    return static_cast<double>(maxCoeff.GetMSB());
+}
+
+LevelManager::LevelManager(CryptoContext<DCRTPoly> context) : m_context(context) {
+    for (const auto& tower : context->GetCryptoParameters()->GetElementParams()->GetParams()) {
+        m_towerBits.push_back(std::log2(tower->GetModulus().ConvertToDouble()));
+    }
+
+    double tBits    = std::log2(static_cast<double>(context->GetCryptoParameters()->GetPlaintextModulus()));
+    m_expansionBits = 0.5 * std::log2(static_cast<double>(context->GetRingDimension()));
+
+    // Heuristic (average-case) bounds: t * (6 sigma) * sqrt(N) for fresh encryptions,
+    // t * sqrt(N) for the rounding term a mod-reduction leaves behind.
+    m_freshBits    = tBits + m_expansionBits + std::log2(6.0 * NOISE_SIGMA) + 1.0;
+    m_roundingBits = tBits + m_expansionBits + 1.0;
+
+    auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(context->GetCryptoParameters());
+    if (cryptoParams == nullptr || cryptoParams->GetScalingTechnique() != FIXEDMANUAL) {
+        std::cerr << "WARNING: LevelManager expects FIXEDMANUAL scaling; the library will also mod-reduce."
+                  << std::endl;
+    }
+}
+
+TrackedCiphertext LevelManager::Track(const Ciphertext<DCRTPoly>& ciphertext) const {
+    return TrackedCiphertext{ciphertext, m_freshBits};
+}
+
+size_t LevelManager::Towers(const TrackedCiphertext& tracked) {
+    return tracked.ciphertext->GetElements()[0].GetNumOfElements();
+}
+
+double LevelManager::ModulusBits(size_t towers) const {
+    double bits = 0;
+    for (size_t i = 0; i < towers; ++i) {
+        bits += m_towerBits[i];
+    }
+    return bits;
+}
+
+double LevelManager::UsableBits(size_t towers) const {
+    return ModulusBits(towers) - 1.0 - NOISE_SAFETY_BITS;
+}
+
+double LevelManager::BudgetBits(const TrackedCiphertext& tracked) const {
+    return ModulusBits(Towers(tracked)) - 1.0 - tracked.noiseBits;
+}
+
+double LevelManager::MultNoiseBits(const TrackedCiphertext& a, const TrackedCiphertext& b) const {
+    // Tensoring multiplies the noises and the ring expansion; relinearization adds roughly fresh noise.
+    return LogAdd(a.noiseBits + b.noiseBits + m_expansionBits + 1.0, m_freshBits);
+}
+
+void LevelManager::ModReduce(TrackedCiphertext& tracked) {
+    size_t towers = Towers(tracked);
+    if (towers <= 1) {
+        return;
+    }
+    m_towersProcessed += towers;
+    // Out of place: the ciphertext may be shared with the caller or other TrackedCiphertexts.
+    tracked.ciphertext = m_context->ModReduce(tracked.ciphertext);
+    tracked.noiseBits = LogAdd(tracked.noiseBits - m_towerBits[towers - 1], m_roundingBits);
+}
+
+void LevelManager::AlignTowers(TrackedCiphertext& a, TrackedCiphertext& b) {
+    while (Towers(a) > Towers(b)) {
+        ModReduce(a);
+    }
+    while (Towers(b) > Towers(a)) {
+        ModReduce(b);
+    }
+}
+
+void LevelManager::Prepare(TrackedCiphertext& tracked, uint32_t remainingDepth) {
+    // Simulate the remaining circuit as repeated squaring with lazy reduction and
+    // report whether it fits into the given number of towers.
+    auto fits = [this, remainingDepth](double noise, size_t towers) {
+        for (uint32_t d = 0; d < remainingDepth; ++d) {
+            double product = LogAdd(2 * noise + m_expansionBits + 1.0, m_freshBits);
+            while (product > UsableBits(towers) && towers > 1) {
+                noise = LogAdd(noise - m_towerBits[towers - 1], m_roundingBits);
+                --towers;
+                product = LogAdd(2 * noise + m_expansionBits + 1.0, m_freshBits);
+            }
+            if (product > UsableBits(towers)) {
+                return false;
+            }
+            noise = product;
+        }
+        return true;
+    };
+
+    while (Towers(tracked) > 1) {
+        size_t towers  = Towers(tracked);
+        double reduced = LogAdd(tracked.noiseBits - m_towerBits[towers - 1], m_roundingBits);
+        if (!fits(reduced, towers - 1)) {
+            break;
+        }
+        ModReduce(tracked);
+    }
+}
+
+TrackedCiphertext LevelManager::EvalAdd(TrackedCiphertext& a, TrackedCiphertext& b) {
+    AlignTowers(a, b);
+    m_towersProcessed += Towers(a) + Towers(b);
+    return TrackedCiphertext{m_context->EvalAdd(a.ciphertext, b.ciphertext), LogAdd(a.noiseBits, b.noiseBits)};
+}
+
+TrackedCiphertext LevelManager::EvalMult(TrackedCiphertext& a, TrackedCiphertext& b) {
+    AlignTowers(a, b);
+
+    // Delay mod-reduction until the product would not fit, and stop as soon as
+    // another reduction no longer buys budget (both operands at the rounding floor).
+    double margin = UsableBits(Towers(a)) - MultNoiseBits(a, b);
+    while (margin < 0 && Towers(a) > 1) {
+        size_t towers = Towers(a);
+        TrackedCiphertext ra{nullptr, LogAdd(a.noiseBits - m_towerBits[towers - 1], m_roundingBits)};
+        TrackedCiphertext rb{nullptr, LogAdd(b.noiseBits - m_towerBits[towers - 1], m_roundingBits)};
+        double reducedMargin = UsableBits(towers - 1) - MultNoiseBits(ra, rb);
+        if (reducedMargin <= margin) {
+            break;
+        }
+        ModReduce(a);
+        // Squaring through one TrackedCiphertext must reduce it only once.
+        if (&b != &a) {
+            ModReduce(b);
+        }
+        margin = reducedMargin;
+    }
+    if (margin < 0) {
+        std::cerr << "WARNING: EvalMult is expected to exhaust the noise budget (" << margin << " bits)." << std::endl;
+    }
+
+    m_towersProcessed += Towers(a) + Towers(b);
+    return TrackedCiphertext{m_context->EvalMult(a.ciphertext, b.ciphertext), MultNoiseBits(a, b)};
+}
+
+double LevelManager::Calibrate(const PrivateKey<DCRTPoly>& secretKey, TrackedCiphertext& tracked) const {
+    double measured   = MeasureNoiseBits(secretKey, tracked.ciphertext);
+    double error      = tracked.noiseBits - measured;
+    tracked.noiseBits = measured;
+    return error;
+}
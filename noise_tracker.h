@@ -0,0 +1,102 @@
+#ifndef NOISE_TRACKER_H
+#define NOISE_TRACKER_H
+
+#include "openfhe.h"
+#include <cstdint>
+#include <vector>
+
+using namespace lbcrypto;
+
+/**
+ * @brief A ciphertext together with a cheap estimate of its noise, in bits.
+ */
+struct TrackedCiphertext {
+    Ciphertext<DCRTPoly> ciphertext;
+    double noiseBits = 0;
+};
+
+/**
+ * @brief Measures the exact noise of a ciphertext with the secret key (for calibration only).
+ * Computes c0 + c1*s + c2*s^2 + ... mod Q and returns log2 of its largest centered coefficient.
+ * @return The measured noise in bits.
+ */
+double MeasureNoiseBits(const PrivateKey<DCRTPoly>& secretKey, const Ciphertext<DCRTPoly>& ciphertext);
+
+/**
+ * @brief Tracks the noise of BGV-RNS ciphertexts and places mod-reductions itself.
+ *
+ * The context must use FIXEDMANUAL scaling so the library does not mod-reduce on its own.
+ * Instead of reducing after every multiplication, the manager only mod-reduces an operand
+ * when the product would otherwise overflow the remaining budget, and Prepare() drops the
+ * towers a ciphertext will never need for the rest of the circuit.
+ */
+class LevelManager {
+public:
+    explicit LevelManager(CryptoContext<DCRTPoly> context);
+
+    /**
+     * @brief Starts tracking a freshly encrypted ciphertext.
+     */
+    TrackedCiphertext Track(const Ciphertext<DCRTPoly>& ciphertext) const;
+
+    /**
+     * @brief Drops every tower not needed for the remaining multiplicative depth.
+     * @param remainingDepth The number of multiplications still to be applied to this ciphertext.
+     */
+    void Prepare(TrackedCiphertext& tracked, uint32_t remainingDepth);
+
+    /**
+     * @brief Adds two tracked ciphertexts.
+     * The operands are modified: the one with more towers is mod-reduced to match the other,
+     * and its ciphertext and estimate are replaced (the original ciphertext is not changed).
+     */
+    TrackedCiphertext EvalAdd(TrackedCiphertext& a, TrackedCiphertext& b);
+
+    /**
+     * @brief Multiplies two tracked ciphertexts, mod-reducing only when the product would not fit.
+     * The operands are modified: they are aligned to the same tower count and, if needed,
+     * mod-reduced further, replacing their ciphertexts and estimates (the original
+     * ciphertexts are not changed).
+     */
+    TrackedCiphertext EvalMult(TrackedCiphertext& a, TrackedCiphertext& b);
+
+    /**
+     * @brief Mod-reduces one tower away, scaling the noise down with it.
+     * The ciphertext is replaced, never modified, so copies sharing it are unaffected.
+     */
+    void ModReduce(TrackedCiphertext& tracked);
+
+    /**
+     * @brief Remaining noise budget in bits: log2(Q/2) of the current towers minus the noise.
+     */
+    double BudgetBits(const TrackedCiphertext& tracked) const;
+
+    /**
+     * @brief Replaces the estimate with an exact secret-key measurement.
+     * @return The difference between the old estimate and the measurement, in bits.
+     */
+    double Calibrate(const PrivateKey<DCRTPoly>& secretKey, TrackedCiphertext& tracked) const;
+
+    /**
+     * @brief Sum of the operand tower counts of every homomorphic operation issued so far.
+     */
+    uint64_t TowersProcessed() const {
+        return m_towersProcessed;
+    }
+
+private:
+    static size_t Towers(const TrackedCiphertext& tracked);
+    double ModulusBits(size_t towers) const;
+    double UsableBits(size_t towers) const;
+    double MultNoiseBits(const TrackedCiphertext& a, const TrackedCiphertext& b) const;
+    void AlignTowers(TrackedCiphertext& a, TrackedCiphertext& b);
+
+    CryptoContext<DCRTPoly> m_context;
+    std::vector<double> m_towerBits;  // log2 of each tower modulus
+    double m_freshBits;               // noise of a fresh encryption
+    double m_roundingBits;            // noise floor left by a mod-reduction
+    double m_expansionBits;           // log2 of the ring expansion factor sqrt(N)
+    uint64_t m_towersProcessed = 0;
+};
+
+#endif // NOISE_TRACKER_H
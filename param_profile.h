@@ -0,0 +1,80 @@
+#ifndef PARAM_PROFILE_H
+#define PARAM_PROFILE_H
+
+#include "openfhe.h"
+#include <cstdint>
+#include <iostream>
+
+using namespace lbcrypto;
+
+/**
+ * @brief The frozen production parameter set, as a configuration guard.
+ * It records the CCParams inputs SetupContext() hard-codes, so every component builds
+ * its context from one definition. It does not change how the library computes.
+ *
+ * The ring dimension and tower count are outputs of OpenFHE's parameter generation and
+ * are only pinned when given at build time with -DHE_PROFILE_RING_DIM=... and
+ * -DHE_PROFILE_TOWERS=... (take the values depth-bgvrns_manualkey_8 prints).
+ * A value of 0 means "not pinned".
+ */
+struct ParamProfile {
+    static constexpr uint32_t depth                    = 3;
+    static constexpr PlaintextModulus plaintextModulus = 536903681;
+    static constexpr uint32_t maxRelinSkDeg            = 3;
+#ifdef HE_PROFILE_RING_DIM
+    static constexpr uint32_t ringDim = HE_PROFILE_RING_DIM;
+#else
+    static constexpr uint32_t ringDim = 0;
+#endif
+#ifdef HE_PROFILE_TOWERS
+    static constexpr uint32_t towers = HE_PROFILE_TOWERS;
+#else
+    static constexpr uint32_t towers = 0;
+#endif
+};
+
+/**
+ * @brief Checks a context (e.g. one deserialized from another node) against the profile.
+ * The ring dimension and tower count are only compared when they are pinned.
+ * @return true if the context matches.
+ */
+inline bool MatchesProfile(const CryptoContext<DCRTPoly>& context) {
+    if (context->GetCryptoParameters()->GetPlaintextModulus() != ParamProfile::plaintextModulus) {
+        return false;
+    }
+    if (ParamProfile::ringDim != 0 && context->GetRingDimension() != ParamProfile::ringDim) {
+        return false;
+    }
+    size_t towers = context->GetCryptoParameters()->GetElementParams()->GetParams().size();
+    return ParamProfile::towers == 0 || towers == ParamProfile::towers;
+}
+
+/**
+ * @brief Builds the production CryptoContext from the profile.
+ * The library still generates the modulus chain; a pinned ring dimension is only checked,
+ * so a library upgrade that changes it is reported instead of silently accepted.
+ * @return The initialized CryptoContext, or nullptr if it does not match the profile.
+ */
+inline CryptoContext<DCRTPoly> SetupProfileContext() {
+    CCParams<CryptoContextBGVRNS> parameters;
+    parameters.SetMultiplicativeDepth(ParamProfile::depth);
+    parameters.SetPlaintextModulus(ParamProfile::plaintextModulus);
+    parameters.SetMaxRelinSkDeg(ParamProfile::maxRelinSkDeg);
+
+    CryptoContext<DCRTPoly> context = GenCryptoContext(parameters);
+    context->Enable(PKE);
+    context->Enable(KEYSWITCH);
+    context->Enable(LEVELEDSHE);
+
+    if (!MatchesProfile(context)) {
+        std::cerr << "ERROR: Context (ring dimension " << context->GetRingDimension() << ", "
+                  << context->GetCryptoParameters()->GetElementParams()->GetParams().size()
+                  << " towers) does not match the pinned ParamProfile!" << std::endl;
+        return nullptr;
+    }
+
+    std::cout << "Context setup complete (BGV-RNS, Depth " << ParamProfile::depth << ", ParamProfile).\n";
+    return context;
+}
+
+#endif // PARAM_PROFILE_H